@@ -80,6 +80,23 @@ SynthesisParameters::setFadeTime;
 ") 
 SynthesisParameters::setSampleRate;
 
+%feature("docstring",
+"Return the number of threads used by the Loris Synthesizer to 
+render Partials. 1 renders Partials serially, 0 uses as many
+threads as the hardware supports.") 
+SynthesisParameters::numThreads;
+
+%feature("docstring",
+"Set the number of threads used by the Loris Synthesizer to 
+render Partials. Partials rendered using more than one thread
+are rendered in groups and accumulated in a fixed order, so the
+synthesized samples do not depend on the number of threads.
+
+	n is the number of threads, 1 (the default) renders Partials 
+	serially, 0 uses as many threads as the hardware supports.
+") 
+SynthesisParameters::setNumThreads;
+
 %feature("docstring",
 "Return the numerator coefficients in the filter used by the Loris 
 Synthesizer in bandwidth-enhanced sinusoidal synthesis.") 
@@ -148,6 +165,22 @@ SynthesisParameters::setFilterCoefs;
             Synthesizer::SetDefaultParameters( params );        
         }
     
+        //  -- default number of threads access and mutation --
+        
+        static unsigned int numThreads( void ) 
+        {
+            return Synthesizer::DefaultParameters().numThreads;
+        }
+    
+    
+        static void setNumThreads( unsigned int n )    
+        {
+            Synthesizer::Parameters params = 
+                Synthesizer::DefaultParameters();
+            params.numThreads = n;
+            Synthesizer::SetDefaultParameters( params );        
+        }
+    
         //  -- filter access and mutation --
         
         static std::vector< double > filterCoefsNumerator( void ) 
@@ -42,8 +42,11 @@
 //  begin namespace
 namespace Loris {
 
+class AssociateBandwidth;
 class Envelope;
 class LinearEnvelopeBuilder;
+class ReassignedSpectrum;
+class SpectralPeakSelector;
 // class Peaks;
 // class Peaks::iterator;
 //  oooo, this is nasty, need to fix it!
@@ -251,6 +254,66 @@ public:
   PartialList analyze(const double *bufBegin, const double *bufEnd,
                       double srate, const Envelope &reference);
 
+  //  -- streaming analysis --
+
+  //! Begin the analysis of a stream of (mono) samples at the given
+  //! sample rate (in Hz). Blocks of samples of any size are supplied by
+  //! analyzeBlock, and the analysis is completed by finishAnalysis.
+  //! Only the samples needed to compute analysis frames that have not
+  //! yet been computed are retained, and Partials are returned as soon
+  //! as they are completed, so streams of any length can be analyzed.
+  //! Any streaming analysis already in progress is abandoned.
+  //!
+  //! Analyzer parameters should not be changed while a streaming
+  //! analysis is in progress. Calling analyze also abandons a streaming
+  //! analysis in progress.
+  //!
+  //! \param  srate is the sample rate of the samples in the stream
+  void beginAnalysis(double srate);
+
+  //! Begin the analysis of a stream of (mono) samples at the given
+  //! sample rate (in Hz). Use the specified envelope as a frequency
+  //! reference for Partial tracking.
+  //!
+  //! \param  srate is the sample rate of the samples in the stream
+  //! \param  reference is an Envelope having the approximate
+  //!         frequency contour expected of the resulting Partials.
+  void beginAnalysis(double srate, const Envelope &reference);
+
+  //! Append a block of samples to the stream being analyzed, analyze
+  //! all frames whose windows are covered by the samples received so
+  //! far, and return the Partials that were completed (those that
+  //! cannot be extended in a later frame). The Partials returned by
+  //! all calls to analyzeBlock and finishAnalysis are the same as
+  //! those that analyze would return for the whole stream, in a
+  //! different order. If an exception is thrown, the streaming
+  //! analysis is abandoned.
+  //!
+  //! \param  bufBegin is a pointer to a buffer of floating point samples
+  //! \param  bufEnd is (one-past) the end of a buffer of floating point
+  //!         samples
+  //! \throw  InvalidObject if no streaming analysis is in progress.
+  PartialList analyzeBlock(const double *bufBegin, const double *bufEnd);
+
+  //! Append a vector of samples to the stream being analyzed, and
+  //! return the Partials that were completed.
+  //!
+  //! \param  vec is a vector of floating point samples
+  //! \throw  InvalidObject if no streaming analysis is in progress.
+  PartialList analyzeBlock(const std::vector<double> &vec);
+
+  //! Complete the streaming analysis in progress, analyzing the
+  //! remaining frames, and return the Partials that have not already
+  //! been returned by analyzeBlock. The fundamental and amplitude
+  //! envelopes are those of the whole stream.
+  //!
+  //! \throw  InvalidObject if no streaming analysis is in progress.
+  PartialList finishAnalysis(void);
+
+  //! Return true if a streaming analysis has been begun, and not
+  //! yet finished or abandoned, and false otherwise.
+  bool analysisInProgress(void) const;
+
   //  -- parameter access --
 
   //! Return the amplitude floor (lowest detected spectral amplitude),
@@ -302,6 +365,11 @@ public:
   //! analysis, and false otherwise. (Default is true.)
   bool phaseCorrect(void) const;
 
+  //! Return the number of threads used to compute the reassigned
+  //! spectra of analysis frames. (Default is 1, analysis is performed
+  //! serially.)
+  unsigned int numThreads(void) const;
+
   //  -- parameter mutation --
 
   //! Set the amplitude floor (lowest detected spectral amplitude), in
@@ -374,6 +442,17 @@ public:
   //!         phase-corrected Partials
   void setPhaseCorrect(bool TF = true);
 
+  //! Set the number of threads used to compute the reassigned spectra
+  //! of analysis frames. Spectra, peak selection, and bandwidth
+  //! association for many frames are computed concurrently, and
+  //! Partials are formed from the selected peaks in frame order, so
+  //! the analysis result does not depend on the number of threads.
+  //!
+  //! \param n is the number of threads to use, or 0 to use as many
+  //!         threads as the hardware supports. 1 (the default)
+  //!         performs the analysis serially.
+  void setNumThreads(unsigned int n);
+
   //  -- bandwidth envelope specification --
 
   enum {
@@ -545,6 +624,10 @@ private:
   bool m_phaseCorrect; //!  flag indicating that phases/frequencies should be
                        //!  made consistent at the end of the analysis
 
+  unsigned int m_numThreads; //!  number of threads used to compute the
+                             //!  spectra of analysis frames, 1 for serial
+                             //!  analysis
+
   //! builder object for constructing a fundamental frequency
   //! estimate during analysis
   std::unique_ptr<LinearEnvelopeBuilder> m_f0Builder;
@@ -553,6 +636,16 @@ private:
   //! estimate during analysis
   std::unique_ptr<LinearEnvelopeBuilder> m_ampEnvBuilder;
 
+  //! the state of an analysis in progress, defined in Analyzer.C
+  struct AnalysisState;
+
+  //! the ordered frequencies of the peaks retained in a frame,
+  //! defined in Analyzer.C
+  class PeakFrequencies;
+
+  //! the state of the streaming analysis in progress, if any
+  std::unique_ptr<AnalysisState> m_stream;
+
   //  -- private auxiliary functions --
   //	future development
   /*
@@ -592,7 +685,10 @@ private:
   //  Rejected peaks are placed at the end of the peak collection.
   //  Return the first position in the collection containing a rejected peak,
   //  or the end of the collection if no peaks are rejected.
-  Peaks::iterator thinPeaks(Peaks &peaks, double frameTime);
+  //  retainedFreqs is scratch storage for the frequencies of the retained
+  //  peaks, reused from frame to frame so that thinning does not allocate.
+  Peaks::iterator thinPeaks(Peaks &peaks, double frameTime,
+                            PeakFrequencies &retainedFreqs);
 
   //  Fix the bandwidth value stored in the specified Peaks.
   //  This function is invoked if the spectral residue method is
@@ -603,6 +699,29 @@ private:
   //  Peak bandwidth is set to zero.
   void fixBandwidth(Peaks &peaks);
 
+  //  Compute the reassigned spectrum of the analysis frame centered at
+  //  winMiddle, and extract, thin, and (if bwAssociator is not null)
+  //  associate bandwidth with its peaks. Rejected peaks are removed.
+  //  Uses no Analyzer state other than the configuration parameters,
+  //  so it may be invoked concurrently with distinct spectra, selectors,
+  //  associators, and scratch storage. The storage of peaks is reused.
+  void extractPeaks(const double *bufBegin, const double *bufEnd,
+                    const double *winMiddle, double frameTime,
+                    ReassignedSpectrum &spectrum,
+                    SpectralPeakSelector &selector,
+                    AssociateBandwidth *bwAssociator,
+                    PeakFrequencies &scratch, Peaks &peaks);
+
+  //  Compute the analysis frames on the half-open range [firstFrame,
+  //  lastFrame), centered every hop from the beginning of the analyzed
+  //  samples, and form Partials from their peaks, using (and updating)
+  //  the specified analysis state. bufBegin is the position of the
+  //  sample having index bufOffset in the analyzed samples, and the
+  //  buffer must contain all samples in the windows of those frames.
+  void analyzeFrames(AnalysisState &state, const double *bufBegin,
+                     const double *bufEnd, long bufOffset, long firstFrame,
+                     long lastFrame);
+
 }; //  end of class Analyzer
 
 } //  end of namespace Loris
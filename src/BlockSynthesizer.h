@@ -0,0 +1,282 @@
+#ifndef INCLUDE_BLOCKSYNTHESIZER_H
+#define INCLUDE_BLOCKSYNTHESIZER_H
+/*
+ * This is the Loris C++ Class Library, implementing analysis,
+ * manipulation, and synthesis of digitized sounds using the Reassigned
+ * Bandwidth-Enhanced Additive Sound Model.
+ *
+ * Loris is Copyright (c) 1999-2016 by Kelly Fitz and Lippold Haken
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY, without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ *
+ * BlockSynthesizer.h
+ *
+ * Definition of class Loris::BlockSynthesizer, a synthesizer of
+ * bandwidth-enhanced Partials that renders successive fixed-size
+ * blocks of samples.
+ *
+ * loris@cerlsoundgroup.org
+ *
+ * http://www.cerlsoundgroup.org/Loris/
+ *
+ */
+
+#include "Breakpoint.h"
+#include "Oscillator.h"
+#include "Partial.h"
+#include "PartialList.h"
+#include "Synthesizer.h"
+
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <vector>
+
+//	begin namespace
+namespace Loris {
+
+// ---------------------------------------------------------------------------
+//	class BlockSynthesizer
+//
+//! A BlockSynthesizer renders bandwidth-enhanced Partials in successive
+//! blocks of samples, for low-latency (e.g. real-time) playback.
+//!
+//!	Class BlockSynthesizer renders the same samples as Synthesizer
+//!	renders for a range of Partials (within the tolerance of the
+//!	Oscillator), configured by the same Parameters,
+//!	but it never allocates a buffer for the whole duration of the
+//!	Partials. Instead, each call to render produces the next block of
+//!	samples. Partials are activated, using an index of their start
+//!	times, in the block in which their onset fade begins, and each
+//!	active Partial has its own Oscillator, the state of which is
+//!	carried from one block to the next. Partials are retired in the
+//!	block in which their fade out ends.
+//!
+//!	The BlockSynthesizer does not copy the Partials, the client must
+//!	ensure that they are not modified or destroyed while they are
+//!	being rendered. (Each Partial is copied, and quantized to the
+//!	synthesis sample rate, when it is activated.)
+//
+class BlockSynthesizer {
+  //	-- public interface --
+public:
+  //! An unsigned integral type large enough to
+  //! represent the length of any block of samples.
+  typedef std::size_t size_type;
+
+  //	-- construction --
+
+  //!	Construct a BlockSynthesizer that renders the Partials on the
+  //!	specified half-open (STL-style) range in blocks of the specified
+  //!	number of samples, using the default Synthesizer parameters.
+  //!
+  //! \param  begin_partials The beginning of the range of Partials
+  //!         to synthesize.
+  //! \param 	end_partials The end of the range of Partials
+  //!         to synthesize.
+  //!	\param	blockSize The number of samples in each rendered block
+  //!			   (must be positive).
+  //!	\throw	InvalidArgument if the block size is zero.
+  //!	\throw	InvalidPartial if any Partial has negative start time.
+#if !defined(NO_TEMPLATE_MEMBERS)
+  template <typename Iter>
+  BlockSynthesizer(Iter begin_partials, Iter end_partials,
+                   size_type blockSize);
+#else
+  BlockSynthesizer(PartialList::const_iterator begin_partials,
+                   PartialList::const_iterator end_partials,
+                   size_type blockSize);
+#endif
+
+  //!	Construct a BlockSynthesizer that renders the Partials on the
+  //!	specified half-open (STL-style) range in blocks of the specified
+  //!	number of samples, using the specified Synthesizer parameters.
+  //!	(The number of threads is ignored, blocks are rendered serially.)
+  //!
+  //! \param  begin_partials The beginning of the range of Partials
+  //!         to synthesize.
+  //! \param 	end_partials The end of the range of Partials
+  //!         to synthesize.
+  //!	\param	blockSize The number of samples in each rendered block
+  //!			   (must be positive).
+  //!	\param	params A Parameters struct storing the configuration of
+  //!             Synthesizer parameters.
+  //!	\throw	InvalidArgument if the block size is zero, or any of the
+  //!			   parameters is invalid.
+  //!	\throw	InvalidPartial if any Partial has negative start time.
+#if !defined(NO_TEMPLATE_MEMBERS)
+  template <typename Iter>
+  BlockSynthesizer(Iter begin_partials, Iter end_partials,
+                   size_type blockSize,
+                   const Synthesizer::Parameters &params);
+#else
+  BlockSynthesizer(PartialList::const_iterator begin_partials,
+                   PartialList::const_iterator end_partials,
+                   size_type blockSize,
+                   const Synthesizer::Parameters &params);
+#endif
+
+  //	-- synthesis --
+
+  //!	Render the next block of samples, and accumulate them into the
+  //!	blockSize() samples starting at block. Previous contents of the
+  //!	block are not overwritten. Partials whose onsets fall in this
+  //!	block are activated, and those whose fade outs end in this block
+  //!	are retired. After all Partials are retired (see done), the
+  //!	rendered blocks are silent.
+  //!
+  //!	\param	block The beginning of a buffer of at least blockSize()
+  //!			   samples.
+  void render(double *block);
+
+  //!	Start over, rendering the first block of samples on the next
+  //!	call to render. All active Partials are retired. (The noise of
+  //!	each Partial is positioned when it is activated, so the same
+  //!	samples are rendered again.)
+  void reset(void);
+
+  //	-- access --
+
+  //!	Return the number of samples in each rendered block.
+  size_type blockSize(void) const;
+
+  //!	Return true if all Partials have been rendered, that is, if
+  //!	there are no more Partials to activate and no active Partials,
+  //!	and false otherwise.
+  bool done(void) const;
+
+  //!	Return this BlockSynthesizer's Partial fade time, in seconds.
+  double fadeTime(void) const;
+
+  //!	Return the number of Partials that are currently active.
+  size_type numActive(void) const;
+
+  //!	Return the index of the first sample of the block that will be
+  //!	rendered by the next call to render.
+  unsigned long position(void) const;
+
+  //!	Return the sampling rate (in Hz) for this BlockSynthesizer.
+  double sampleRate(void) const;
+
+  //	-- implementation --
+private:
+  typedef unsigned long index_type;
+
+  //	An active Partial, rendered by its own Oscillator as a sequence
+  //	of linear segments ending at its Breakpoint times, quantized to the
+  //	synthesis sample rate, and a final fade out segment. Segments may
+  //	span several blocks. Voices are recycled when their Partials are
+  //	retired, to avoid reallocating Oscillators and segment storage.
+  struct Voice {
+    Oscillator osc;
+
+    //	the sample index and target of each segment:
+    std::vector<std::pair<index_type, Breakpoint>> segments;
+
+    size_type nextSegment;   //	the segment being rendered
+    bool segmentBegun;       //	some samples of nextSegment are rendered
+    index_type currentSamp;  //	the next sample to render
+    double prevFrequency;    //	target frequency of the previous segment
+  };
+
+  //	A Partial to render, the sample before which it must be activated
+  //	(a little before its onset fade begins), and its index in the range
+  //	of Partials, which determines the position of its bandwidth-
+  //	enhancement noise (see Oscillator::NoiseStride).
+  struct Entry {
+    index_type activation;
+    index_type index;
+    const Partial *partial;
+  };
+
+  //	Compute the sample before which each Partial in m_partials must be
+  //	activated, and sort them by that sample. Partials having no
+  //	Breakpoints are removed.
+  void buildIndex(void);
+
+  //	Activate the specified Partial, initializing a Voice to render it.
+  void activate(const Entry &e);
+
+  //	Render samples of the specified Voice in the current block, which
+  //	begins at m_position. Return true if the Partial is finished.
+  bool renderVoice(Voice &v, double *block);
+
+  //	Partials, sorted by activation sample, and the
+  //	index of the next one to activate:
+  std::vector<Entry> m_partials;
+  size_type m_nextPartial;
+
+  //	active Voices are at the beginning, retired ones after:
+  std::vector<std::unique_ptr<Voice>> m_voices;
+  size_type m_numActive;
+
+  index_type m_position; //  index of the first sample in the next block
+  size_type m_blockSize; //  samples per block
+
+  Synthesizer::Parameters m_params; //  fade time, sample rate, and filter
+
+  // --- disallow copy and assignment ---
+
+  BlockSynthesizer(const BlockSynthesizer &);
+  BlockSynthesizer &operator=(const BlockSynthesizer &);
+
+}; //	end of class BlockSynthesizer
+
+#if !defined(NO_TEMPLATE_MEMBERS)
+// ---------------------------------------------------------------------------
+//	constructor
+// ---------------------------------------------------------------------------
+//!	Construct a BlockSynthesizer that renders the Partials on the
+//!	specified half-open (STL-style) range in blocks of the specified
+//!	number of samples, using the default Synthesizer parameters.
+//
+template <typename Iter>
+BlockSynthesizer::BlockSynthesizer(Iter begin_partials, Iter end_partials,
+                                   size_type blockSize)
+    : m_nextPartial(0), m_numActive(0), m_position(0), m_blockSize(blockSize),
+      m_params(Synthesizer::DefaultParameters()) {
+  while (begin_partials != end_partials) {
+    m_partials.push_back(
+        Entry{0, index_type(m_partials.size()), &(*(begin_partials++))});
+  }
+  buildIndex();
+}
+
+// ---------------------------------------------------------------------------
+//	constructor
+// ---------------------------------------------------------------------------
+//!	Construct a BlockSynthesizer that renders the Partials on the
+//!	specified half-open (STL-style) range in blocks of the specified
+//!	number of samples, using the specified Synthesizer parameters.
+//
+template <typename Iter>
+BlockSynthesizer::BlockSynthesizer(Iter begin_partials, Iter end_partials,
+                                   size_type blockSize,
+                                   const Synthesizer::Parameters &params)
+    : m_nextPartial(0), m_numActive(0), m_position(0), m_blockSize(blockSize),
+      m_params(params) {
+  Synthesizer::IsValidParameters(m_params);
+  while (begin_partials != end_partials) {
+    m_partials.push_back(
+        Entry{0, index_type(m_partials.size()), &(*(begin_partials++))});
+  }
+  buildIndex();
+}
+#endif
+
+} // namespace Loris
+
+#endif /* ndef INCLUDE_BLOCKSYNTHESIZER_H */
@@ -71,6 +71,9 @@ class Distiller {
 
   double _fadeTime, _gapTime; // distillation parameters
 
+  unsigned int _numThreads; //! number of threads used to distill Partials
+                            //! having different labels.
+
   //  -- public interface --
 public:
   //  -- global defaults and constants --
@@ -120,6 +123,21 @@ public:
 
   //  Use compiler-generated copy, assign, and destroy.
 
+  //  -- access/mutation --
+
+  //! Return the number of threads used to distill Partials having
+  //! different labels. (Default is 1, labels are distilled serially.)
+  unsigned int numThreads(void) const;
+
+  //! Set the number of threads used to distill Partials having different
+  //! labels. Partials having a given label are always distilled together,
+  //! so the result does not depend on the number of threads.
+  //!
+  //! \param  n is the number of threads to use, or 0 to use as many
+  //!         threads as the hardware supports. 1 (the default) distills
+  //!         labels serially.
+  void setNumThreads(unsigned int n);
+
   //  -- distillation --
 
   //! Distill labeled Partials in a collection leaving only a single
@@ -99,6 +99,17 @@ public:
   F0Estimate(const std::vector<double> &amps, const std::vector<double> &freqs,
              double fmin, double fmax, double resolution);
 
+  //! Construct as above, using the specified vectors as scratch
+  //! storage for the candidate frequencies and the values of the
+  //! likelihood function at those frequencies. Their storage is
+  //! reused, so estimating frame after frame (as in Analyzer) using
+  //! the same vectors does not allocate, once they have grown to
+  //! accommodate the largest frame.
+
+  F0Estimate(const std::vector<double> &amps, const std::vector<double> &freqs,
+             double fmin, double fmax, double resolution,
+             std::vector<double> &candidates, std::vector<double> &likelihoods);
+
   //  default copy/assign/destroy are OK
 
   //  Not sure whether or why these would be useful.
@@ -118,6 +129,16 @@ public:
 
   double confidence(void) const { return m_confidence; }
 
+private:
+  //  --- implementation ---
+
+  //  Compute the estimate, using the specified scratch storage,
+  //  invoked by the constructors.
+  void estimate(const std::vector<double> &amps,
+                const std::vector<double> &freqs, double fmin, double fmax,
+                double resolution, std::vector<double> &eval_freqs,
+                std::vector<double> &Q);
+
 }; //  end of class F0Estimate
 
 } // namespace Loris
@@ -39,7 +39,6 @@
 #include "Notifier.h"
 
 #include <algorithm>
-#include <deque>
 #include <vector>
 
 //  begin namespace
@@ -66,11 +65,11 @@ namespace Loris {
 //! G is the additional filter gain, and is unity if unspecified.
 //!
 //!
-//! Filter is implemented using a std::deque to store the filter state,
-//! and relies on the efficiency of that class. If deque is not implemented
-//! using some sort of circular buffer (as it should be -- deque is guaranteed
-//! to be efficient for repeated insertion and removal at both ends), then
-//! this filter class will be slow.
+//! The filter state is stored in a fixed-size circular buffer. Blocks of
+//! samples can be filtered at once, and filters of low order (up to 4,
+//! including the filter used for bandwidth-enhanced synthesis) are then
+//! computed by kernels specialized for their order, that keep the filter
+//! state in local variables.
 //
 class Filter {
 public:
@@ -132,6 +131,17 @@ public:
   //! \return the next output sample
   double apply(double input);
 
+  //! Filter a block of samples. Compute n filtered samples from the
+  //! next n input samples, starting at in, and store them starting at
+  //! out. The input and output may be the same buffer. The result is
+  //! the same as that of applying the filter to each input sample in
+  //! turn.
+  //!
+  //!	\param in is the beginning of the block of input samples
+  //!	\param out is the beginning of the block of output samples
+  //!	\param n is the number of samples to filter
+  void apply(const double *in, double *out, unsigned long n);
+
   //! Function call operator, same as sample().
   //!
   //! \sa apply
@@ -169,8 +179,14 @@ public:
 private:
   //  --- implementation ---
 
-  //! single delay line for Direct-Form II implementation
-  std::deque<double> m_delayline;
+  //! the filter order, the number of values in the delay line
+  unsigned int m_order;
+
+  //! single delay line for Direct-Form II implementation, stored twice
+  //! in a circular buffer of length 2*order, so that the values, newest
+  //! first, are contiguous starting at m_pos
+  std::vector<double> m_delayline;
+  unsigned int m_pos;
 
   //! feed-forward coefficients
   std::vector<double> m_ffwdcoefs;
@@ -215,8 +231,9 @@ inline Filter::Filter(const double *ffwdbegin,
                       double gain)
     :
 #endif
+      m_order(std::max(ffwdend - ffwdbegin, fbackend - fbackbegin) - 1),
+      m_delayline(2 * m_order, 0.), m_pos(0),
       m_ffwdcoefs(ffwdbegin, ffwdend), m_fbackcoefs(fbackbegin, fbackend),
-      m_delayline(std::max(ffwdend - ffwdbegin, fbackend - fbackbegin) - 1, 0.),
       m_gain(gain) {
   if (*fbackbegin == 0.) {
     Throw(InvalidObject, "Tried to create a Filter with feeback coefficient at "
@@ -37,6 +37,7 @@
  *
  */
 #include <complex>
+#include <string>
 #include <vector>
 
 //	begin namespace
@@ -58,10 +59,18 @@ class FTimpl;
 //! accessed by subscript or iterator. FourierTransform computes a complex
 //! transform, so it can be used to invert a transform of real samples
 //! as well. Uses the standard library complex class, which implements
-//! arithmetic operations.
+//! arithmetic operations. A real-input transform, computing only the
+//! non-negative frequency half of the spectrum, is also provided.
 //!
-//! Supports FFTW versions 2 and 3.
-//! Does not make use of FFTW "wisdom" to speed up transform computation.
+//! The transform buffer is allocated by the transform implementation
+//! (aligned for FFTW, if FFTW is used), and the transform is computed
+//! in-place in that buffer, so no data is copied in or out.
+//!
+//! Supports FFTW versions 2 and 3. Using FFTW version 3, transform plans
+//! are computed using FFTW_MEASURE, and are shared by all instances
+//! having the same size, so planning is performed only once per size.
+//! Accumulated FFTW "wisdom" can be saved and restored using
+//! exportWisdom and importWisdom, to avoid measuring at all.
 //!
 //! If FFTW is unavailable, uses instead the General Purpose FFT package
 //! by Takuya OOURA, http://momonga.t.u-tokyo.ac.jp/~ooura/fft.html defined
@@ -76,10 +85,10 @@ public:
   typedef std::vector<std::complex<double>>::size_type size_type;
 
   //! The type of a non-const iterator of (complex) transform samples.
-  typedef std::vector<std::complex<double>>::iterator iterator;
+  typedef std::complex<double> *iterator;
 
   //! The type of a const iterator of (complex) transform samples.
-  typedef std::vector<std::complex<double>>::const_iterator const_iterator;
+  typedef const std::complex<double> *const_iterator;
 
   //	--- lifecycle ---
 
@@ -146,28 +155,28 @@ public:
   //!
   //! \return a non-const iterator refering to the first position
   //!         in the transform buffer.
-  iterator begin(void) { return _buffer.begin(); }
+  iterator begin(void) { return _buffer; }
 
   //! Return an iterator refering to the end of the sequence of
   //! complex samples in the transform buffer.
   //!
   //! \return a non-const iterator refering to one past the last
   //!         position in the transform buffer.
-  iterator end(void) { return _buffer.end(); }
+  iterator end(void) { return _buffer + _size; }
 
   //! Return a const iterator refering to the beginning of the sequence of
   //! complex samples in the transform buffer.
   //!
   //! \return a const iterator refering to the first position
   //!         in the transform buffer.
-  const_iterator begin(void) const { return _buffer.begin(); }
+  const_iterator begin(void) const { return _buffer; }
 
   //! Return a const iterator refering to the end of the sequence of
   //! complex samples in the transform buffer.
   //!
   //! \return a const iterator refering to one past the last
   //!         position in the transform buffer.
-  const_iterator end(void) const { return _buffer.end(); }
+  const_iterator end(void) const { return _buffer + _size; }
 
   //	--- operations ---
 
@@ -177,6 +186,29 @@ public:
   //! transformed samples, in-place.
   void transform(void);
 
+  //! Return a pointer to the beginning of the buffer of real
+  //! input samples for the real-input transform (transformReal).
+  //! The real samples share storage with the complex transform
+  //! buffer, so the real input is overwritten by the complex
+  //! transform output. Use this member to fill the buffer with
+  //! size() real samples before invoking transformReal.
+  //!
+  //! \return a pointer to the first of size() real samples.
+  double *realBuffer(void) {
+    return reinterpret_cast<double *>(_buffer);
+  }
+
+  //! Compute the Fourier transform of the size() real samples
+  //! stored in the real input buffer (see realBuffer). The real
+  //! samples are replaced, in-place, by the complex transform
+  //! samples at non-negative frequencies, indices 0 through size()/2,
+  //! inclusive. The remaining (negative frequency) samples are the
+  //! complex conjugates of these, and are not computed, so the
+  //! contents of the rest of the transform buffer are unspecified.
+  //! For power-of-two sizes (or any size, using FFTW version 3),
+  //! this is about half the work of the complex transform.
+  void transformReal(void);
+
   //	--- inquiry ---
 
   //! Return the length of the transform (in samples).
@@ -184,17 +216,42 @@ public:
   //! \return the length of the transform in samples.
   size_type size(void) const;
 
+  //	--- FFTW wisdom ---
+
+  //! Import FFTW wisdom (accumulated transform plans) from the
+  //! specified file, so that plans for transform sizes described
+  //! by the wisdom need not be measured. Has no effect unless
+  //! FFTW version 3 is used.
+  //!
+  //! \param  path is the name of the file storing the wisdom.
+  //! \return true if the wisdom was successfully imported, false
+  //!         otherwise.
+  static bool importWisdom(const std::string &path);
+
+  //! Export all accumulated FFTW wisdom (transform plans) to the
+  //! specified file, from which it can be restored, in this process
+  //! or another, using importWisdom. Has no effect unless FFTW
+  //! version 3 is used.
+  //!
+  //! \param  path is the name of the file in which to store the wisdom.
+  //! \return true if the wisdom was successfully exported, false
+  //!         otherwise.
+  static bool exportWisdom(const std::string &path);
+
   //	-- instance variables --
 private:
-  //! buffer containing the complex transform input before
-  //! computing the transform, and the complex transform output
-  //! after computing the transform
-  std::vector<std::complex<double>> _buffer;
-
   // insulating implementation instance (defined in
   // FourierTransform.C), conceals interface to FFTW
   FTimpl *_impl;
 
+  //! buffer containing the complex transform input before
+  //! computing the transform, and the complex transform output
+  //! after computing the transform, owned by _impl
+  std::complex<double> *_buffer;
+
+  //! the length of the transform (in samples)
+  size_type _size;
+
 }; //	end of class FourierTransform
 
 } // namespace Loris
@@ -155,6 +155,21 @@ public:
   using std::map<double, double>::iterator;
   using std::map<double, double>::const_iterator;
 
+  //  -- evaluation at increasing times --
+
+  //! Return the linearly-interpolated value of this LinearEnvelope at
+  //! the specified time, using the specified position, which must be
+  //! the position of the first breakpoint not earlier than t (or end()),
+  //! instead of searching for it. The result is the same as valueAt(t).
+  //! This is used to evaluate the envelope at many increasing times,
+  //! advancing the position from one time to the next.
+  //!
+  //! \param  t is the time at which to evaluate this
+  //!         LinearEnvelope.
+  //! \param  pos is the position of the first breakpoint at or
+  //!         later than t.
+  double valueAt(double t, const_iterator pos) const;
+
 }; //  end of class LinearEnvelope
 
 //  --  binary operators (inline nonmembers) --
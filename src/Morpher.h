@@ -35,6 +35,7 @@
 #include "Partial.h"
 #include "PartialList.h"
 
+#include <map>
 #include <memory> // for auto_ptr
 
 //  begin namespace
@@ -108,6 +109,10 @@ class Morpher {
                            //! domain, if false (default) they  are morphed
                            //! in the linear domain.
 
+  unsigned int _numThreads; //! number of threads used to morph the
+                            //! corresponding pairs of labeled Partials
+                            //! (default is 1, morph serially).
+
   //  -- public interface --
 public:
   //  -- construction --
@@ -368,6 +373,24 @@ public:
   //! \throw  InvalidArgument if the specified gap is not positive
   void setMinBreakpointGap(double x);
 
+  //! Return the number of threads used to morph corresponding
+  //! pairs of labeled Partials. (Default is 1, Partials are morphed
+  //! serially.)
+  unsigned int numThreads(void) const;
+
+  //! Set the number of threads used to morph corresponding pairs of
+  //! labeled Partials in morph(). If not 1, the pairs are morphed
+  //! concurrently, and the morphed Partials are stored in the
+  //! Morpher's PartialList in label order, as they are when morphed
+  //! serially, so the result does not depend on the number of threads.
+  //! (The morphing envelopes are evaluated concurrently, the Envelopes
+  //! provided by Loris are all safe to use this way.)
+  //!
+  //! \param  n is the number of threads to use, or 0 to use as many
+  //!         threads as the hardware supports. 1 (the default) morphs
+  //!         Partials serially.
+  void setNumThreads(unsigned int n);
+
   //  -- reference Partial label access/mutation --
 
   //! Return the Partial to be used as a reference
@@ -523,6 +546,19 @@ private:
   //! morph() implementation accepting two sequences of Partials.
   void morph_aux(PartialCorrespondence &correspondence);
 
+  //! Helper function that morphs a single pair of corresponding
+  //! Partials, assigning the specified label to the morphed Partial.
+  //! Called by morph_aux, possibly concurrently for different pairs.
+  Partial morphCorrespondingPair(Partial::label_type label,
+                                 MorphingPair match);
+
+  //! MorphCursors evaluates the source and target Partials, the
+  //! reference Partials, and the morphing functions at the increasing
+  //! times of the Breakpoints in a pair of Partials being morphed,
+  //! advancing through their Breakpoints instead of searching for
+  //! every evaluation. (Defined in Morpher.C.)
+  struct MorphCursors;
+
   //! Compute morphed parameter values at the specified time, using
   //! the source Breakpoint (assumed to correspond exactly to the
   //! specified time) and the target Partial (whose parameters are
@@ -534,14 +570,16 @@ private:
   //!
   //! \param  srcBkpt is the Breakpoint corresponding to a morph function
   //!         value of 0.
-  //! \param  tgtPartial is the Partial corresponding to a morph function
-  //!         value of 1, evaluated at the specified time.
+  //! \param  cursors evaluates the Partial corresponding to a morph
+  //!         function value of 1, the reference Partials, and the
+  //!         morphing functions, at times not earlier than the
+  //!         times of previous evaluations.
   //! \param  time is the time corresponding to srcBkpt (used
   //!         to evaluate the morphing functions and tgtPartial).
   //! \param  newp is the morphed Partial under construction, the morphed
   //!         Breakpoint is added to this Partial.
   //
-  void appendMorphedSrc(Breakpoint srcBkpt, const Partial &tgtPartial,
+  void appendMorphedSrc(Breakpoint srcBkpt, MorphCursors &cursors,
                         double time, Partial &newp);
 
   //! Compute morphed parameter values at the specified time, using
@@ -555,14 +593,16 @@ private:
   //!
   //! \param  tgtBkpt is the Breakpoint corresponding to a morph function
   //!         value of 1.
-  //! \param  srcPartial is the Partial corresponding to a morph function
-  //!         value of 0, evaluated at the specified time.
+  //! \param  cursors evaluates the Partial corresponding to a morph
+  //!         function value of 0, the reference Partials, and the
+  //!         morphing functions, at times not earlier than the
+  //!         times of previous evaluations.
   //! \param  time is the time corresponding to srcBkpt (used
   //!         to evaluate the morphing functions and srcPartial).
   //! \param  newp is the morphed Partial under construction, the morphed
   //!         Breakpoint is added to this Partial.
   //
-  void appendMorphedTgt(Breakpoint tgtBkpt, const Partial &srcPartial,
+  void appendMorphedTgt(Breakpoint tgtBkpt, MorphCursors &cursors,
                         double time, Partial &newp);
 
   //!	Parameterinterpolation helpers.
@@ -35,12 +35,23 @@
  *
  */
 
+#include <cstdint>
+
 //	begin namespace
 namespace Loris {
 
 // ---------------------------------------------------------------------------
 //	class NoiseGenerator
 //
+//!	NoiseGenerator generates Gaussian noise having zero mean and unity
+//!	standard deviation. The generator is counter-based: each sample is
+//!	a function only of the seed and of the index (position) of the
+//!	sample in the noise sequence, so the generator can skip ahead to
+//!	any position, and the noise for any range of positions can be
+//!	generated independently (for example, by different threads) with
+//!	the same result. Blocks of samples are generated by loops having no
+//!	dependence from one sample to the next.
+//
 class NoiseGenerator {
   //	--- interface ---
 
@@ -53,7 +64,8 @@ public:
 
   //	copy and assign are free
 
-  //!	Re-seed the random number generator.
+  //!	Re-seed the random number generator, and start over at the
+  //!	beginning of the noise sequence for the new seed.
   //!
   //!	\param newSeed is the new seed for the random number generator
   void seed(double newSeed);
@@ -62,11 +74,9 @@ public:
   //
   //!	Generate and return a new sample of Gaussian noise having zero
   //! mean and unity standard deviation. Approximate the normal distribution
-  //!	using the Box-Muller transformation applied to a uniform random number
-  //!	generator taken from "Random Number Generators: Good Ones Are Hard To
-  //! Find," 	Stephen Park and Keith Miller, Communications of the ACM,
-  //! October 1988,
-  //! vol. 31, Number 10.
+  //!	using the Box-Muller transformation applied to pairs of uniform
+  //!	random numbers computed by hashing the seed and the position of the
+  //!	pair in the noise sequence.
   double sample(void);
 
   //! Function call operator, same as calling sample().
@@ -74,16 +84,42 @@ public:
   //!	\sa sample
   double operator()(void) { return sample(); }
 
+  //	generate
+  //
+  //!	Generate samples of Gaussian noise (the same samples that would be
+  //!	returned by successive calls to sample()), and store them in the
+  //!	half-open (STL-style) range of doubles, starting at begin and ending
+  //!	before end.
+  //!
+  //!	\param begin is the beginning of the range of samples to generate
+  //!	\param end is the end of the range of samples to generate
+  void generate(double *begin, double *end);
+
+  //	--- position in the noise sequence ---
+
+  //!	Return the position in the noise sequence of the next
+  //!	sample to be generated.
+  std::uint64_t position(void) const { return m_counter; }
+
+  //!	Set the position in the noise sequence of the next
+  //!	sample to be generated.
+  //!
+  //!	\param pos is the new position in the noise sequence
+  void setPosition(std::uint64_t pos) { m_counter = pos; }
+
+  //!	Skip the specified number of samples in the noise sequence.
+  //!
+  //!	\param nsamps is the number of samples to skip
+  void skip(std::uint64_t nsamps) { m_counter += nsamps; }
+
   //	--- implementation ---
 private:
   //	random number generation helpers
-  inline double uniform(void);
-  inline double gaussian_normal(void);
+  inline std::uint64_t hash(std::uint64_t pair) const;
 
   // random number generator state variables
-  double m_useed;
-  double m_gset;
-  bool m_iset;
+  std::uint64_t m_key;     //  derived from the seed
+  std::uint64_t m_counter; //  position of the next sample
 };
 
 } // namespace Loris
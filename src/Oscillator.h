@@ -103,9 +103,26 @@ public:
   //! ending before end (no sample is accumulated at end). The caller must
   //! insure that the indices are valid. Target frequency and bandwidth are
   //! checked to prevent aliasing and bogus bandwidth enhancement.
+  //!
+  //! Samples are rendered by a bank of recursive oscillators running
+  //! in lock-step (see Oscillator.C), rather than by evaluating a cosine
+  //! for every sample. Rendered samples differ from directly-evaluated
+  //! ones by less than 1e-10 times the oscillator amplitude.
   void oscillate(double *begin, double *end, const Breakpoint &bp,
                  double srate);
 
+  //! Accumulate the first (end - begin) samples of a segment of nsamps
+  //! samples, modulating the oscillator state from its current values
+  //! toward the specified target values, which are reached at the end
+  //! of the segment. The oscillator state is left at its values on the
+  //! segment trajectory at end, so that the rest of the segment can be
+  //! rendered by another call, toward the same target, with nsamps
+  //! reduced by (end - begin). This is used to render segments that
+  //! span several blocks of samples. If (end - begin) is not less
+  //! than nsamps, this is the same as oscillate( begin, end, bp, srate ).
+  void oscillate(double *begin, double *end, const Breakpoint &bp,
+                 double srate, long nsamps);
+
   // --- accessors ---
 
   //! Return the instantaneous amplitde of the Oscillator.
@@ -124,6 +141,11 @@ public:
   //! implement bandwidth-enhanced sinusoidal synthesis.
   Filter &filter(void) { return m_filter; }
 
+  //! Return access to the NoiseGenerator used by this oscillator as
+  //! its stochastic modulator (can use this access to position the
+  //! modulator in its noise sequence).
+  NoiseGenerator &modulator(void) { return m_modulator; }
+
   // --- static members ---
 
   //! Static local function for obtaining a prototype Filter
@@ -131,6 +153,14 @@ public:
   //! external (client) specification of the Filter prototype.
   static const Filter &prototype_filter(void);
 
+  //! The number of noise samples reserved for each Partial in a
+  //! range of Partials. The modulator of an Oscillator rendering the
+  //! Partial at index k in the range is positioned at k * NoiseStride,
+  //! so that each Partial has distinct bandwidth-enhancement noise,
+  //! independent of the order in which the Partials are rendered.
+  //! (2^32 samples is more than a day of noise at 44.1 kHz.)
+  static const std::uint64_t NoiseStride = std::uint64_t(1) << 32;
+
 }; //  end of class Oscillator
 
 } //  end of namespace Loris
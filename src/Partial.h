@@ -39,7 +39,9 @@
 #include "Breakpoint.h"
 #include "LorisExceptions.h"
 
-#include <map>
+#include <iterator>
+#include <utility>
+#include <vector>
 
 //	begin namespace
 namespace Loris {
@@ -69,6 +71,14 @@ class Partial_ConstIterator;
 //! members, returning 	the Breakpoint (by reference) at the current iterator
 //! position and the 	time (by value) corresponding to that Breakpoint.
 //!
+//!	The time-Breakpoint pairs are stored contiguously, in time order,
+//!	so (as with iterators on a std::vector) inserting or removing
+//!	Breakpoints invalidates iterators (and Breakpoint references) at
+//!	and after the point of insertion or removal, and insertion may
+//!	invalidate all of them. Use the iterators returned by insert and
+//!	erase. Inserting Breakpoints in time order (appending) takes
+//!	constant (amortized) time.
+//!
 //!	Partial is a leaf class, do not subclass.
 //!
 //!	Most of the implementation of Partial delegates to a few
@@ -78,6 +88,7 @@ class Partial_ConstIterator;
 //!		default construction
 //!		copy (construction)
 //!		operator= (assign)
+//!		swap
 //!		operator== (equivalence)
 //!		size
 //!		insert( pos, Breakpoint )
@@ -94,12 +105,12 @@ public:
   //	-- types --
 
   //!	underlying Breakpoint container type, used by
-  //!	the iterator types defined below:
-  typedef std::map<double, Breakpoint> container_type;
+  //!	the iterator types defined below, a sequence of
+  //!	(time, Breakpoint) pairs sorted by time:
+  typedef std::vector<std::pair<double, Breakpoint>> container_type;
 
-  //	typedef std::vector< std::pair< double, Breakpoint > > container_type;
   //	see Partial.C for a discussion of issues surrounding the
-  //	choice of std::map as a Breakpoint container.
+  //	choice of std::vector as a Breakpoint container.
 
   //! 32 bit type for labeling Partials
   typedef int label_type;
@@ -146,6 +157,12 @@ public:
   //!	\param	other is the Partial to copy.
   Partial &operator=(const Partial &other);
 
+  //!	Exchange the Breakpoints and label of this Partial with those
+  //!	of another Partial, without copying either envelope.
+  //!
+  //!	\param	other is the Partial to exchange with.
+  void swap(Partial &other);
+
   //	-- container-dependent implementation --
 
   //!	Return an iterator refering to the position of the first
@@ -283,6 +300,28 @@ public:
   //!	\param	other is the Partial to absorb.
   void absorb(const Partial &other);
 
+  //!	Append copies of all the Breakpoints in another Partial, that
+  //!	must begin no earlier than this Partial ends, after the last
+  //!	Breakpoint in this Partial. This is equivalent to inserting
+  //!	each of the other Partial's Breakpoints in turn, but the
+  //!	Breakpoints are copied all at once. (As when inserting, if
+  //!	the other Partial begins less than 1 ns after this Partial
+  //!	ends, then the last Breakpoint in this Partial is replaced.)
+  //!
+  //!	\param	other is the Partial whose Breakpoints to append.
+  //!	\throw	InvalidArgument if other begins before this Partial
+  //!			ends.
+  void append(const Partial &other);
+
+  //!	Reserve storage for at least the specified number of
+  //!	Breakpoints, so that Breakpoints can be appended up
+  //!	to that number without reallocating. This does not
+  //!	change the Breakpoints in this Partial.
+  //!
+  //!	\param	n is the number of Breakpoints to reserve
+  //!			storage for.
+  void reserve(size_type n);
+
   //!	Remove the Breakpoint at the position of the given
   //!	iterator, invalidating the iterator. Return a
   //!	iterator referring to the next valid position, or to
@@ -431,6 +470,27 @@ public:
   Breakpoint parametersAt(double time,
                           double fadeTime = ShortestSafeFadeTime) const;
 
+  //!	Return the interpolated parameters of this Partial at the
+  //!	specified time, using the specified position, which must be
+  //!	the position returned by findAfter(time), instead of searching
+  //!	for it. The result is the same as parametersAt(time, fadeTime).
+  //!	This is used to evaluate a Partial at many increasing times,
+  //!	advancing the position from one time to the next.
+  //!
+  //!	\param	time is the time in seconds at which to evaluate the
+  //!			Partial.
+  //!	\param	pos is the position of the first Breakpoint at or after
+  //!			time (or end()), as returned by findAfter(time).
+  //!	\param	fadeTime is the duration in seconds over which Partial
+  //!			amplitudes fade at the ends. The default value is
+  //!			ShortestSafeFadeTime, 1 ns.
+  //!	\return	A Breakpoint describing the parameters of this Partial
+  //!			at the specified time.
+  //! \pre	The Partial must have at least one Breakpoint.
+  //!	\throw	InvalidPartial if the Partial has no Breakpoints.
+  Breakpoint parametersAt(double time, const_iterator pos,
+                          double fadeTime = ShortestSafeFadeTime) const;
+
   //	-- implementation --
 private:
   label_type _label;
@@ -441,7 +501,7 @@ private:
 // ---------------------------------------------------------------------------
 //	class Partial_Iterator
 //
-//!	Non-const iterator for the Loris::Partial Breakpoint map. Wraps
+//!	Non-const iterator for the Loris::Partial Breakpoint envelope. Wraps
 //!	the non-const iterator for the (time,Breakpoint) pair container
 //!	Partial::container_type. Partial_Iterator implements a
 //!	bidirectional iterator interface, and additionally offers time
@@ -461,7 +521,7 @@ public:
 
   //! The iterator category, for copmpatibility with
   //! C++ standard library algorithms
-  typedef BaseIterator::iterator_category iterator_category;
+  typedef std::bidirectional_iterator_tag iterator_category;
 
   //! The type of element that can be accessed through this
   //! iterator (Breakpoint).
@@ -621,7 +681,7 @@ private:
 // ---------------------------------------------------------------------------
 //	class Partial_ConstIterator
 //
-//!	Const iterator for the Loris::Partial Breakpoint map. Wraps
+//!	Const iterator for the Loris::Partial Breakpoint envelope. Wraps
 //!	the non-const iterator for the (time,Breakpoint) pair container
 //!	Partial::container_type. Partial_Iterator implements a
 //!	bidirectional iterator interface, and additionally offers time
@@ -640,7 +700,7 @@ public:
 
   //! The iterator category, for copmpatibility with
   //! C++ standard library algorithms
-  typedef BaseIterator::iterator_category iterator_category;
+  typedef std::bidirectional_iterator_tag iterator_category;
 
   //! The type of element that can be accessed through this
   //! iterator (Breakpoint).
@@ -98,6 +98,15 @@ public:
   //  set of Partials.
   PartialList finishBuilding(void);
 
+  //  releaseFinished
+  //
+  //	Remove and return the Partials that were built and that can no
+  //	longer be extended, because no peak was appended to them in the
+  //	most recent frame. The Partials that are still eligible to be
+  //	extended are retained, and are returned by a later call to
+  //	releaseFinished or finishBuilding.
+  PartialList releaseFinished(void);
+
 private:
   // --- auxiliary member functions ---
 
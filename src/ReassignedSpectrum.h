@@ -34,11 +34,15 @@
  */
 
 #include "FourierTransform.h"
+#include <memory>
 #include <vector>
 
 //	begin namespace
 namespace Loris {
 
+//  shared, immutable analysis windows, defined in ReassignedSpectrum.C
+struct ReassignmentWindows;
+
 // ---------------------------------------------------------------------------
 //	class ReassignedSpectrum
 //
@@ -66,7 +70,18 @@ public:
   ReassignedSpectrum(const std::vector<double> &window,
                      const std::vector<double> &windowDerivative);
 
+  //! Construct a new instance using a Kaiser window (see KaiserWindow.h)
+  //! having the specified length and shaping parameter, and its time
+  //! derivative. The windows are computed only once per process for
+  //! each length and shape, and shared by all instances using them,
+  //! so constructing many instances having the same parameters (in any
+  //! thread) is cheap.
+  //!	Transform lengths are the smallest power of two greater than twice the
+  //!	window length.
+  ReassignedSpectrum(size_type winlen, double winshape);
+
   // compiler-generated copy, assign, and destroy are sufficient
+  // (copies share the windows, which are never modified)
 
   //	--- operations ---
 
@@ -89,6 +104,23 @@ public:
   void transform(const double *sampsBegin, const double *pos,
                  const double *sampsEnd);
 
+  //! Enable or disable caching of reassignment data. If enabled,
+  //! transform computes the frequency and time corrections, magnitude,
+  //! convergence, and spectrum value for every frequency sample (bin)
+  //! in the non-negative half of the spectrum in a single pass, and
+  //! the reassigned transform access members read from these arrays
+  //! instead of recomputing them from the transform buffers on every
+  //! call. This is much cheaper when most bins are inspected (as
+  //! in peak selection). Disabled by default.
+  //!
+  //! \param TF is a flag indicating whether or not to cache reassignment
+  //!         data in transform.
+  void setCacheReassignment(bool TF = true);
+
+  //! Return true if reassignment data for all bins is computed
+  //! and cached by transform, and false otherwise.
+  bool cacheReassignment(void) const;
+
   //	--- inquiry ---
 
   //! Return the length of the Fourier transforms.
@@ -181,27 +213,34 @@ public:
   std::complex<double> operator[](unsigned long idx) const;
 
 private:
-  //	-- window building helpers --
-
-  //	Build a pair of complex-valued windows, one having the frequency-ramp
-  //  (time-derivative) window in the real part and the time-ramp window in the
-  //  imagnary part, and the other having the unmodified window in the real part
-  //  and, if computing mixed deriviatives, the time-ramp time-derivative window
-  //  in the imaginary part.
-  //
-  //  Input is the unmodified window function.
-  void buildReassignmentWindows(const std::vector<double> &window);
-
-  //	Build a pair of complex-valued windows, one having the frequency-ramp
-  //  (time-derivative) window in the real part and the time-ramp window in the
-  //  imagnary part, and the other having the unmodified window in the real part
-  //  and, if computing mixed deriviatives, the time-ramp time-derivative window
-  //  in the imaginary part.
-  //
-  //  Input is the unmodified window function and its time derivative, so the
-  //  DFT kludge is unnecessary.
-  void buildReassignmentWindows(const std::vector<double> &window,
-                                const std::vector<double> &windowDerivative);
+  //	-- reassignment data cache helpers --
+
+  //  Compute the reassignment data for all bins in the non-negative
+  //  half of the spectrum, and store it in the bin arrays.
+  void computeBinData(void);
+
+  //  Return true if the reassignment data for the specified bin
+  //  is stored in the bin arrays.
+  bool binIsCached(long idx) const {
+    return mBinsValid && idx >= 0 &&
+           idx < static_cast<long>(mBinFreqCorrection.size());
+  }
+
+  //  Return the (circular even part of the) magnitude transform
+  //  at the specified bin, from the bin arrays, if possible.
+  std::complex<double> spectrumAt(long idx) const;
+
+  //	-- transform helpers --
+
+  //  Compute the transform of the windowed samples on the range
+  //  [sampsBegin, sampsEnd), rotated left by rotateBy samples and
+  //  zero-padded to the length of result, storing it in result.
+  //  There are at most half as many samples as the transform length,
+  //  so the first stage of a decimation-in-frequency FFT is trivial,
+  //  and only its two half-length transforms need to be computed.
+  void prunedTransform(const double *sampsBegin, const double *sampsEnd,
+                       const std::complex<double> *win, long rotateBy,
+                       FourierTransform &result);
 
   //	-- instance variables --
 
@@ -211,16 +250,35 @@ private:
   //! the FourierTransform for computing time and frequency corrections
   FourierTransform mCorrectionTransform;
 
-  //! the original short-time analysis window samples
-  std::vector<double> mWindow; //  W(n)
-
-  //! the complex window used to compute the
-  //! magnitude/phase transform
-  std::vector<std::complex<double>> mCplxWin_W_Wtd; //  real W(n), imag nW'(n)
-
-  //! the complex window used to compute the
-  //! time/frequency correction transform
-  std::vector<std::complex<double>> mCplxWin_Wd_Wt; //  real W'(n), imag nW(n)
+  //! the half-length FourierTransforms of the even and odd parts of
+  //! the rotated input, from which prunedTransform computes the even
+  //! and odd bins of the full-length transforms
+  FourierTransform mEvenTransform;
+  FourierTransform mOddTransform;
+
+  //! the analysis window, the complex windows used to compute the
+  //! magnitude/phase and time/frequency correction transforms, and
+  //! the roots of unity used by prunedTransform, shared by copies
+  //! (and by instances using the same Kaiser window), never modified
+  std::shared_ptr<const ReassignmentWindows> mWindows;
+
+  //! flag indicating that reassignment data is to be computed
+  //! for all bins, and cached, in transform
+  bool mCacheReassignment;
+
+  //! flag indicating that the bin arrays store data for the
+  //! current transform
+  bool mBinsValid;
+
+  //  structure-of-arrays reassignment data, one element per bin
+  //  in the non-negative half of the spectrum, computed in transform
+  //  if mCacheReassignment is true:
+  std::vector<double> mBinFreqCorrection; //  fractional frequency samples
+  std::vector<double> mBinTimeCorrection; //  fractional samples
+  std::vector<double> mBinMagnitude;      //  absolute
+  std::vector<double> mBinConvergence;    //  on the range [0,1]
+  std::vector<double> mBinReal;           //  real part of spectrum
+  std::vector<double> mBinImag;           //  imaginary part of spectrum
 
 }; //	end of class ReassignedSpectrum
 
@@ -105,12 +105,29 @@ public:
   //!	The type of the Partial storage in an AiffFile.
   typedef PartialList partials_type;
 
+  //! The type of the set of Partial labels to import from an SdifFile.
+  typedef std::vector<Partial::label_type> labels_type;
+
   //	-- construction --
 
   //! Initialize an instance of SdifFile by importing Partial data from
   //! the file having the specified filename or path.
   explicit SdifFile(const std::string &filename);
 
+  //! Initialize an instance of SdifFile by importing only part of the
+  //! Partial data from the file having the specified filename or path:
+  //! the Breakpoints at times in the range [tbeg, tend], in Partials
+  //! having one of the specified labels (or any label, if none are
+  //! specified). All Markers are imported.
+  //!
+  //! Only the frames that can contain selected Breakpoints are read,
+  //! found using the index written by writeIndex, if it is current,
+  //! otherwise by scanning the frame and matrix headers in the file.
+  //!
+  //! \throw InvalidArgument if tbeg is greater than tend.
+  SdifFile(const std::string &filename, double tbeg, double tend,
+           const labels_type &labels = labels_type());
+
   //! Initialize an instance of SdifFile with copies of the Partials
   //! on the specified half-open (STL-style) range.
   //!
@@ -174,6 +191,14 @@ public:
   //! format, resampled, and without phase or bandwidth information.
   void write1TRC(const std::string &path);
 
+  //	-- indexing --
+
+  //! Write an index of the frames in the SDIF file having the specified
+  //! filename or path to a sidecar file having the same name with ".idx"
+  //! appended, to speed up importing part of the Partial data from that
+  //! file. The index is ignored if the SDIF file is later changed.
+  static void writeIndex(const std::string &filename);
+
   //	-- legacy export --
 
   //! Export the Partials in the specified PartialList to a SDIF file having
@@ -73,6 +73,9 @@ class Sieve {
                     //! a Partial when determining overlap, to accomodate
                     //! the fade to and from zero amplitude.
 
+  unsigned int _numThreads; //! number of threads used to sift Partials
+                            //! having different labels.
+
   //  -- public interface --
 public:
   //  -- global defaults and constants --
@@ -109,6 +112,21 @@ public:
 
   //  Use compiler-generated copy, assign, and destroy.
 
+  //  -- access/mutation --
+
+  //! Return the number of threads used to sift Partials having
+  //! different labels. (Default is 1, labels are sifted serially.)
+  unsigned int numThreads(void) const;
+
+  //! Set the number of threads used to sift Partials having different
+  //! labels. Partials having a given label are always sifted together,
+  //! so the result does not depend on the number of threads.
+  //!
+  //! \param  n is the number of threads to use, or 0 to use as many
+  //!         threads as the hardware supports. 1 (the default) sifts
+  //!         labels serially.
+  void setNumThreads(unsigned int n);
+
   //  -- sifting --
 
   //! Sift labeled Partials on the specified half-open (STL-style)
@@ -186,7 +204,9 @@ private:
   //!   ends of each Partial), then set the label of the Partial having the
   //!   shorter duration to zero. Sifting is performed on a collection of
   //!   pointers to Partials so that the it can be performed without changing
-  //!   the order of the Partials in the sequence.
+  //!   the order of the Partials in the sequence. Partials having
+  //!   different labels are sifted concurrently if more than one thread
+  //!   is used (see setNumThreads).
   //!
   //!   \param   ptrs is a collection of pointers to the Partials in the
   //!            sequence to be sifted.
@@ -63,6 +63,13 @@ public:
   //  separate class, but for now, they are just separate functions.
   Peaks selectPeaks(ReassignedSpectrum &spectrum, double minFrequency = 0);
 
+  //	Collect magnitude peaks as above, replacing the contents of the
+  //	specified collection. Its storage is reused, so selecting peaks
+  //	into the same collection frame after frame does not allocate,
+  //	once it has grown to accommodate the largest frame.
+  void selectPeaks(ReassignedSpectrum &spectrum, double minFrequency,
+                   Peaks &peaks);
+
   // --- implementation ---
 private:
   //  There are two strategies for doing. Probably each one should be a
@@ -70,9 +77,10 @@ private:
   //
   //  Currently, the reassignment minima are used.
 
-  Peaks selectReassignmentMinima(ReassignedSpectrum &spectrum,
-                                 double minFrequency);
-  Peaks selectMagnitudePeaks(ReassignedSpectrum &spectrum, double minFrequency);
+  void selectReassignmentMinima(ReassignedSpectrum &spectrum,
+                                double minFrequency, Peaks &peaks);
+  void selectMagnitudePeaks(ReassignedSpectrum &spectrum, double minFrequency,
+                            Peaks &peaks);
 
   // --- member data ---
 
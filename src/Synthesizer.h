@@ -169,7 +169,9 @@ public:
   //!	including the fade outs. Previous contents of the buffer are not
   //!	overwritten. Partials with start times earlier than the Partial fade
   //!	time will have shorter onset fades.  Partials are not rendered at
-  //! frequencies above the half-sample rate.
+  //! frequencies above the half-sample rate. Partials are rendered
+  //! in fixed-size groups, concurrently if the number of threads is
+  //! not 1 (see setNumThreads).
   //!
   //! \param  begin_partials The beginning of the range of Partials
   //!         to synthesize.
@@ -217,6 +219,10 @@ public:
   //!	Return the sampling rate (in Hz) for this Synthesizer.
   double sampleRate(void) const;
 
+  //!	Return the number of threads used by this Synthesizer to render
+  //!	ranges of Partials. (Default is 1, Partials are rendered serially.)
+  unsigned int numThreads(void) const;
+
   //!	Set this Synthesizer's fade time to the specified value
   //!	(in seconds, must be non-negative).
   //!
@@ -231,6 +237,18 @@ public:
   //!	\throw	InvalidArgument if the specified rate is nonpositive.
   void setSampleRate(double rate);
 
+  //!	Set the number of threads used by this Synthesizer to render
+  //!	ranges of Partials. The Partials on a range are divided into
+  //!	fixed-size groups, each group is rendered (with a newly-reset
+  //!	Oscillator) into its own buffer, and the buffers are accumulated
+  //!	into the sample buffer in order, so the rendered samples are
+  //!	identical for any number of threads.
+  //!
+  //!	\param	n is the number of threads to use, or 0 to use as many
+  //!			threads as the hardware supports. 1 (the default) renders
+  //!			the groups in the calling thread.
+  void setNumThreads(unsigned int n);
+
   //! Return access to the Filter used by this Synthesizer's
   //! Oscillator to implement bandwidth-enhanced sinusoidal
   //! synthesis. (Can use this access to make changes to the
@@ -251,6 +269,7 @@ public:
   struct Parameters {
     double fadeTime;
     double sampleRate;
+    unsigned int numThreads;
     // EnhancementFlag enhancement;
 
     Filter filter;
@@ -289,6 +308,17 @@ public:
 
   //	-- implementation --
 private:
+  //	Render a single Partial using the specified Oscillator, and
+  //	accumulate the samples into buffer, the first element of which
+  //	stores the sample at index offset. Resize the buffer as necessary.
+  void renderPartial(Partial p, Oscillator &osc, std::vector<double> &buffer,
+                     unsigned long offset) const;
+
+  //	Render all the Partials in the specified vector in groups, using
+  //	the specified number of threads (see setNumThreads).
+  void synthesizeGroups(const std::vector<const Partial *> &partials,
+                        unsigned int nthreads);
+
   Oscillator m_osc; //  the Synthesizer has-a Oscillator that it uses to render
                     //  all the Partials one by one.
 
@@ -299,6 +329,9 @@ private:
   double m_fadeTimeSec; //  Partial fade in/out time in seconds
   double m_srateHz;     //	sample rate in Hz
 
+  unsigned int m_numThreads; //  number of threads used to render ranges of
+                             //  Partials, 0 for the hardware concurrency
+
 }; //	end of class Synthesizer
 
 // ---------------------------------------------------------------------------
@@ -343,9 +376,11 @@ inline void Synthesizer::synthesize(PartialList::const_iterator begin_partials,
     m_sampleBuffer->resize(Nsamps);
   }
 
+  std::vector<const Partial *> partials;
   while (begin_partials != end_partials) {
-    synthesize(*(begin_partials++));
+    partials.push_back(&(*(begin_partials++)));
   }
+  synthesizeGroups(partials, m_numThreads);
 }
 
 // ---------------------------------------------------------------------------